@@ -27,6 +27,7 @@
 		DEFINES
 ==============================================================================*/
 # define MAX_TASKS	3
+# define MAX_SCHED_SLOTS	32
 
 # define MAX_QUEUES	3
 # define CAPACITY	6
@@ -52,6 +53,12 @@ typedef enum e_task_state
 	TASK_BLOCKED
 }	t_task_state;
 
+typedef enum e_sched_mode
+{
+	SCHED_DYNAMIC,
+	SCHED_STATIC
+}	t_sched_mode;
+
 typedef struct s_tcb
 {
 	int				id;
@@ -63,6 +70,12 @@ typedef struct s_tcb
 	unsigned long	next_run;
 }	t_tcb;
 
+typedef struct s_sched_slot
+{
+	unsigned long	offset_ms;
+	int				task_id;
+}	t_sched_slot;
+
 typedef struct s_msg_queue
 {
 	uint8_t	buffer[CAPACITY * ITEM_SIZE];
@@ -91,9 +104,15 @@ extern int			g_num_tasks;
 //	rtos.c
 int				rtos_init(void);
 int				rtos_task_create(t_task_func func, void *arg, unsigned int period_ms);
+int				rtos_set_sched_mode(t_sched_mode mode);
 void			rtos_start(void);
 void			rtos_delay(unsigned int ms);
 void			rtos_yield(void);
+//	rtos.c (internal, used by sched.c)
+int				rtos_dispatch(t_tcb *task, unsigned long now);
+//	sched.c
+int				sched_build(void);
+void			sched_run(void) __attribute__((noreturn));
 //	tasks.c
 void			task_sensor(void *arg);
 void			task_proc(void *arg);
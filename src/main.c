@@ -36,6 +36,11 @@ int	main(void)
 		printf("Error\nrtos_task_create failed\n");
 		return (1);
 	}
+	if (rtos_set_sched_mode(SCHED_STATIC) != 0)
+	{
+		printf("Error\nrtos_set_sched_mode failed\n");
+		return (1);
+	}
 	rtos_start();
 	return (0);
 }
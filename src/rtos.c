@@ -21,7 +21,8 @@ t_tcb		g_task_list[MAX_TASKS];
 int			g_task_blocked_on[MAX_TASKS];
 int			g_num_tasks;
 //	static globals
-static uint8_t	g_yield_requested = 0;
+static uint8_t		g_yield_requested = 0;
+static t_sched_mode	g_sched_mode = SCHED_DYNAMIC;
 
 /*==============================================================================
 	INITIALIZATION
@@ -81,6 +82,27 @@ int	rtos_task_create(t_task_func func, void *arg, unsigned int period_ms)
 /*==============================================================================
 	SCHEDULING
 ==============================================================================*/
+/*
+ * rtos_set_sched_mode():
+ *	Selects how rtos_start releases periodic tasks.
+ *	- SCHED_DYNAMIC: next_run is checked on every scheduler pass (default).
+ *	- SCHED_STATIC: releases follow a dispatch table built over the
+ *		hyperperiod (see sched.c). Aperiodic tasks stay dynamic.
+ *	Notes:
+ *		- In SCHED_STATIC a periodic job only completes when the task returns
+ *			without yielding. A task that ends every step with rtos_delay
+ *			stays pending, so its releases are dropped as overruns and it
+ *			runs at its delay rate instead.
+ *	Must be called before rtos_start. Returns -1 on an unknown mode.
+ */
+int	rtos_set_sched_mode(t_sched_mode mode)
+{
+	if (mode != SCHED_DYNAMIC && mode != SCHED_STATIC)
+		return (-1);
+	g_sched_mode = mode;
+	return (0);
+}
+
 /*
  * rtos_start():
  *	Main RTOS scheduler loop.
@@ -88,6 +110,8 @@ int	rtos_task_create(t_task_func func, void *arg, unsigned int period_ms)
  *	- Iterates over tasks in round-robin fashion.
  *	- Executes TASK_READY tasks whose next_run has elapsed.
  *	- Handles task yield via rtos_yield.
+ *	- In SCHED_STATIC mode hands over to sched_run, falling back to
+ *		the dynamic loop if no dispatch table can be built.
  *	Notes:
  *		- This is not preemptive.
  *		- Tasks must yield cooperatively if long-running.
@@ -99,35 +123,60 @@ void	rtos_start(void)
 	int				id;
 
 	printf("[RTOS] Starting scheduler with %d tasks\n", g_num_tasks);
+	if (g_sched_mode == SCHED_STATIC)
+	{
+		if (sched_build() != 0)
+		{
+			printf("[RTOS] Static schedule unavailable, using dynamic\n");
+			g_sched_mode = SCHED_DYNAMIC;
+		}
+		else
+			sched_run();
+	}
 	while (1)
 	{
 		for (id = 0; id < g_num_tasks; id++)
 		{
 			now = get_time_ms();
-			g_yield_requested = 0;
 			task = &g_task_list[id];
 			if (task->state == TASK_BLOCKED)
 				continue ;
 			if (now < task->next_run)
 				continue ;
-			g_curr_task = task;
-			task->state = TASK_RUNNING;
-			task->func(task->arg);
-			if (g_yield_requested)
-			{
-				g_yield_requested = 0;
-				continue ;
-			}
-			task->state = TASK_READY;
-			if (task->period_ms > 0)
-				task->next_run = now + task->period_ms;
-			task->pc = 0;
+			rtos_dispatch(task, now);
 		}
 		g_curr_task = NULL;
 		usleep(500);
 	}
 }
 
+/*
+ * rtos_dispatch():
+ *	Runs one step of a task and updates its state afterwards.
+ *	- If the task yielded, its job is left pending (pc is kept).
+ *	- Otherwise the job is complete: pc is reset and next_run is moved
+ *		one period ahead of now.
+ *	Returns 1 if the job completed, 0 if it is still pending.
+ *	Shared by the dynamic loop and sched_run.
+ */
+int	rtos_dispatch(t_tcb *task, unsigned long now)
+{
+	g_yield_requested = 0;
+	g_curr_task = task;
+	task->state = TASK_RUNNING;
+	task->func(task->arg);
+	if (g_yield_requested)
+	{
+		g_yield_requested = 0;
+		return (0);
+	}
+	task->state = TASK_READY;
+	task->pc = 0;
+	if (task->period_ms > 0)
+		task->next_run = now + task->period_ms;
+	return (1);
+}
+
 /*
  * rtos_yield():
  *	Causes the current task to voluntarily give up CPU time.
@@ -144,7 +193,7 @@ void	rtos_yield(void)
  *	Delays the current task for the specified milliseconds.
  *	- Updates the task's next_run time.
  *	- Immediately yields control to the scheduler.
- *	Useful to simulate sensor acquisition times or periodic operations.
+ *	Useful to wait inside a job, e.g. between two steps of a task.
  */
 void	rtos_delay(unsigned int ms)
 {
@@ -0,0 +1,278 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sched.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: kebris-c <kebris-c@student.42madrid.com    +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/11/28 10:12:31 by kebris-c          #+#    #+#             */
+/*   Updated: 2025/11/28 10:12:31 by kebris-c         ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "rtos.h"
+
+#if MAX_TASKS > 32
+# error "sched.c tracks pending jobs in a 32-bit mask"
+#endif
+
+/*==============================================================================
+	INTERNAL STATE (static globals)
+==============================================================================*/
+static t_sched_slot		g_sched_table[MAX_SCHED_SLOTS];
+static int				g_sched_slots = 0;
+static unsigned long	g_hyperperiod_ms = 0;
+//	bit id set: task id has a released job that has not completed yet
+static uint32_t			g_sched_pending = 0;
+static unsigned long	g_sched_overruns[MAX_TASKS];
+
+/*==============================================================================
+	TABLE GENERATION
+==============================================================================*/
+static unsigned long	sched_gcd(unsigned long a, unsigned long b)
+{
+	unsigned long	tmp;
+
+	while (b != 0)
+	{
+		tmp = a % b;
+		a = b;
+		b = tmp;
+	}
+	return (a);
+}
+
+/*
+ * sched_hyperperiod():
+ *	Computes the LCM of all periodic task periods.
+ *	Returns 0 if there are no periodic tasks or the LCM overflows.
+ */
+static unsigned long	sched_hyperperiod(void)
+{
+	unsigned long	lcm;
+	unsigned long	step;
+	int				id;
+
+	lcm = 0;
+	for (id = 0; id < g_num_tasks; id++)
+	{
+		if (g_task_list[id].period_ms == 0)
+			continue ;
+		if (lcm == 0)
+		{
+			lcm = g_task_list[id].period_ms;
+			continue ;
+		}
+		step = g_task_list[id].period_ms / sched_gcd(lcm, \
+				g_task_list[id].period_ms);
+		if (lcm > (unsigned long)-1 / step)
+			return (0);
+		lcm *= step;
+	}
+	return (lcm);
+}
+
+/*
+ * sched_insert():
+ *	Inserts a job into the table keeping it sorted by offset.
+ *	Jobs released at the same offset keep task creation order, which is
+ *	the same order the dynamic round-robin would run them in.
+ */
+static void	sched_insert(unsigned long offset_ms, int task_id)
+{
+	int	i;
+
+	i = g_sched_slots;
+	while (i > 0 && g_sched_table[i - 1].offset_ms > offset_ms)
+	{
+		g_sched_table[i] = g_sched_table[i - 1];
+		i--;
+	}
+	g_sched_table[i].offset_ms = offset_ms;
+	g_sched_table[i].task_id = task_id;
+	g_sched_slots++;
+}
+
+/*
+ * sched_build():
+ *	Builds the static dispatch table for the current task set.
+ *	- One slot per periodic job over the hyperperiod, sorted by release.
+ *	- Aperiodic tasks (period 0) are left out and marked as always
+ *		pending, so sched_run schedules them dynamically.
+ *	Returns -1 if there is nothing to table or the table would exceed
+ *	MAX_SCHED_SLOTS; the caller should then fall back to dynamic mode.
+ */
+int	sched_build(void)
+{
+	unsigned long	offset;
+	unsigned long	jobs;
+	int				id;
+
+	g_sched_slots = 0;
+	g_sched_pending = 0;
+	memset(g_sched_overruns, 0, sizeof(g_sched_overruns));
+	g_hyperperiod_ms = sched_hyperperiod();
+	if (g_hyperperiod_ms == 0)
+		return (-1);
+	jobs = 0;
+	for (id = 0; id < g_num_tasks; id++)
+		if (g_task_list[id].period_ms > 0)
+			jobs += g_hyperperiod_ms / g_task_list[id].period_ms;
+	if (jobs > MAX_SCHED_SLOTS)
+		return (-1);
+	for (id = 0; id < g_num_tasks; id++)
+	{
+		if (g_task_list[id].period_ms == 0)
+		{
+			g_sched_pending |= 1u << id;
+			continue ;
+		}
+		for (offset = 0; offset < g_hyperperiod_ms; \
+				offset += g_task_list[id].period_ms)
+			sched_insert(offset, id);
+	}
+	printf("[RTOS] Static schedule: %d jobs over %lu ms hyperperiod\n", \
+		g_sched_slots, g_hyperperiod_ms);
+	return (0);
+}
+
+/*==============================================================================
+	DISPATCH
+==============================================================================*/
+/*
+ * sched_step():
+ *	Runs one step of a pending job and clears its pending bit once a
+ *	periodic job completes. Aperiodic tasks stay pending forever.
+ */
+static void	sched_step(t_tcb *task, unsigned long now)
+{
+	if (rtos_dispatch(task, now) && task->period_ms > 0)
+		g_sched_pending &= ~(1u << task->id);
+}
+
+/*
+ * sched_release():
+ *	Releases a new job of a periodic task and runs its first step.
+ *	- If the previous job is still pending (yielded, delayed or blocked),
+ *		the release is an overrun and is dropped. The first overrun of each
+ *		task is reported, since a task that ends every step with
+ *		rtos_delay never completes a job and loses all its releases.
+ *	- A release older than one period (missed during a stall) is dropped
+ *		too, so a late scheduler does not run a burst of stale jobs.
+ */
+static void	sched_release(t_tcb *task, unsigned long release, \
+		unsigned long now)
+{
+	if (g_sched_pending & (1u << task->id))
+	{
+		if (g_sched_overruns[task->id]++ == 0)
+			printf("[RTOS] Task %d overrun: release dropped, job still "
+				"pending\n", task->id);
+		return ;
+	}
+	if (now - release >= task->period_ms)
+		return ;
+	g_sched_pending |= 1u << task->id;
+	task->next_run = release;
+	sched_step(task, now);
+}
+
+/*
+ * sched_run_pending():
+ *	One round-robin pass over pending jobs only (continuations after a
+ *	yield, delayed or unblocked tasks, aperiodic tasks).
+ */
+static void	sched_run_pending(void)
+{
+	unsigned long	now;
+	t_tcb			*task;
+	int				id;
+
+	for (id = 0; id < g_num_tasks; id++)
+	{
+		if (!(g_sched_pending & (1u << id)))
+			continue ;
+		now = get_time_ms();
+		task = &g_task_list[id];
+		if (task->state == TASK_BLOCKED || now < task->next_run)
+			continue ;
+		sched_step(task, now);
+	}
+}
+
+/*
+ * sched_next_wake():
+ *	Returns the earliest time anything can run: the next table release,
+ *	or an earlier next_run of a pending job that is not blocked.
+ *	Blocked jobs are ignored: only a running task can unblock them.
+ */
+static unsigned long	sched_next_wake(unsigned long next_release)
+{
+	unsigned long	wake;
+	int				id;
+
+	wake = next_release;
+	for (id = 0; g_sched_pending != 0 && id < g_num_tasks; id++)
+	{
+		if (!(g_sched_pending & (1u << id)) \
+				|| g_task_list[id].state == TASK_BLOCKED)
+			continue ;
+		if (g_task_list[id].next_run < wake)
+			wake = g_task_list[id].next_run;
+	}
+	return (wake);
+}
+
+/*
+ * sched_run():
+ *	Static (cyclic executive) scheduler loop. Never returns.
+ *	- Periodic releases come from the table: a cursor steps through it
+ *		instead of checking every task's next_run on each pass.
+ *	- Only pending jobs are scanned; with none pending the loop sleeps
+ *		straight until the next release instead of polling.
+ *	- After a stall of a whole hyperperiod or more, epoch is resynced by
+ *		whole hyperperiods and stale releases are dropped.
+ *	Notes:
+ *		- Release times are relative to the moment sched_run starts and
+ *			repeat every hyperperiod.
+ *		- Pending jobs that are ready are polled every 500 us, as in the
+ *			dynamic loop, so cooperative steps stay paced the same way.
+ */
+void	sched_run(void)
+{
+	unsigned long	epoch;
+	unsigned long	now;
+	unsigned long	wake;
+	int				slot;
+
+	epoch = get_time_ms();
+	slot = 0;
+	while (1)
+	{
+		if (g_sched_pending != 0)
+			sched_run_pending();
+		now = get_time_ms();
+		if (now >= epoch + g_hyperperiod_ms)
+		{
+			epoch += (now - epoch) / g_hyperperiod_ms * g_hyperperiod_ms;
+			slot = 0;
+		}
+		while (now >= epoch + g_sched_table[slot].offset_ms)
+		{
+			sched_release(&g_task_list[g_sched_table[slot].task_id], \
+				epoch + g_sched_table[slot].offset_ms, now);
+			if (++slot == g_sched_slots)
+			{
+				slot = 0;
+				epoch += g_hyperperiod_ms;
+			}
+		}
+		g_curr_task = NULL;
+		now = get_time_ms();
+		wake = sched_next_wake(epoch + g_sched_table[slot].offset_ms);
+		if (wake > now)
+			usleep((useconds_t)((wake - now) * 1000));
+		else
+			usleep(500);
+	}
+}
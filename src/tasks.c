@@ -19,7 +19,7 @@
  * task_sensor():
  *	Simulates reading from a 12-bit ADC sensor.
  *	- Sends the raw sensor value to QUEUE_SENSOR.
- *	- Uses rtos_delay to simulate acquisition time.
+ *	- Completes its job in one step, so its rate is set by period_ms.
  *	Notes:
  *		- Each task iteration is independent.
  *		- Uses pc and static variables to maintain state across yields.
@@ -36,7 +36,6 @@ void	task_sensor(void *arg)
 			if (queue_send_msg(QUEUE_SENSOR, &adc_raw_data, \
 					sizeof(adc_raw_data)) == -1)
 				return ;
-			rtos_delay(50);
 			return ;
 	}
 }